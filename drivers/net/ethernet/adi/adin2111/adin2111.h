@@ -17,6 +17,10 @@
 #include <linux/workqueue.h>
 #include <linux/mutex.h>
 #include <linux/spinlock.h>
+#include <linux/bitfield.h>
+#include <asm/unaligned.h>
+
+#include "adin2111_regs.h"
 
 #define ADIN2111_PORTS		2
 #define ADIN2111_PORT_1		0
@@ -107,6 +111,88 @@ struct adin2111_priv {
 	u8 phy_addr[ADIN2111_PORTS];
 };
 
+/* Decoded RX frame descriptor */
+struct adin2111_rx_desc {
+	u16 fsize;	/* Bytes to read from the RX FIFO */
+	u16 offset;	/* Start of the Ethernet frame in the FIFO data */
+	u16 len;	/* Ethernet frame length */
+	u8 port;	/* Source port, only set by adin2111_rx_decode_hdr() */
+};
+
+/*
+ * RX descriptor decode. STATUS0 RX error bits and the RX_FSIZE word are
+ * checked before the FIFO is read, so bad frames are dropped before an skb
+ * is allocated. @hdr_len is the number of header bytes the caller's FIFO
+ * data starts with (0 if the variant reads the bare frame); where a header
+ * is present, adin2111_rx_decode_hdr() takes length and port from its
+ * 16-bit word. Errors map to rx stats in adin2111_rx_count_drop().
+ */
+static inline int adin2111_rx_decode_status(u32 status0)
+{
+	if (status0 & ADIN2111_STATUS0_RXBOE)
+		return -ENOBUFS;
+	if (status0 & ADIN2111_STATUS0_RXEVM)
+		return -EBADMSG;
+
+	return 0;
+}
+
+static inline int adin2111_rx_decode_size(u32 rx_fsize, unsigned int hdr_len,
+					  unsigned int max_len,
+					  struct adin2111_rx_desc *desc)
+{
+	desc->fsize = FIELD_GET(ADIN2111_RX_FSIZE_MASK, rx_fsize);
+	if (desc->fsize < hdr_len + ETH_HLEN ||
+	    desc->fsize > hdr_len + max_len)
+		return -EMSGSIZE;
+
+	desc->offset = hdr_len;
+	desc->len = desc->fsize - hdr_len;
+
+	return 0;
+}
+
+static inline int adin2111_rx_decode_hdr(const u8 *buf,
+					 struct adin2111_rx_desc *desc)
+{
+	u16 hdr = get_unaligned_be16(buf);
+	u16 len = FIELD_GET(ADIN2111_FRAME_HEADER_LEN_MASK, hdr);
+
+	/* Frame length comes from the header, bounded by the FIFO data */
+	if (len < ETH_HLEN || len > desc->len)
+		return -EMSGSIZE;
+
+	desc->len = len;
+
+	/* Port field bit 1 selects port 2, as in the original RX parse */
+	desc->port = (FIELD_GET(ADIN2111_FRAME_HEADER_PORT_MASK, hdr) & BIT(1)) ?
+		     ADIN2111_PORT_2 : ADIN2111_PORT_1;
+
+	return 0;
+}
+
+static inline void adin2111_rx_count_drop(struct rtnl_link_stats64 *stats,
+					  int err)
+{
+	stats->rx_errors++;
+
+	switch (err) {
+	case -EMSGSIZE:
+		stats->rx_length_errors++;
+		break;
+	case -ENOBUFS:
+		stats->rx_over_errors++;
+		break;
+	case -EBADMSG:
+	case -EPROTO:
+		stats->rx_frame_errors++;
+		break;
+	default:
+		stats->rx_fifo_errors++;	/* SPI/FIFO read failure */
+		break;
+	}
+}
+
 /* Function prototypes */
 
 /* Main driver */
@@ -260,76 +260,98 @@ out:
 /* Currently unused - will be used when interrupt handling is implemented */
 void __maybe_unused adin2111_rx_handler(struct adin2111_priv *priv)
 {
-	u32 rx_fsize, frame_size, port_mask;
-	u8 *frame_buf;
+	struct adin2111_rx_desc desc;
+	u8 *frame_buf = NULL;
 	struct sk_buff *skb;
 	struct net_device *netdev;
 	struct adin2111_port *port;
-	u16 frame_header;
-	int ret, port_num;
+	u32 status0, rx_fsize;
+	int ret;
 
 	/* Read frame size */
 	ret = adin2111_read_reg(priv, ADIN2111_RX_FSIZE, &rx_fsize);
 	if (ret || !rx_fsize)
 		return;
 
-	frame_size = rx_fsize & 0x7FF;
-	if (frame_size < ADIN2111_FRAME_HEADER_LEN ||
-	    frame_size > ADIN2111_MAX_FRAME_SIZE + ADIN2111_FRAME_HEADER_LEN) {
-		dev_err(&priv->spi->dev, "Invalid frame size: %u\n", frame_size);
+	/* Until the header is decoded, drops are charged to port 1 */
+	port = &priv->ports[0];
+
+	/* Flush the RX FIFO if the MAC flagged an RX error */
+	ret = adin2111_read_reg(priv, ADIN2111_STATUS0, &status0);
+	if (ret)
 		return;
+
+	ret = adin2111_rx_decode_status(status0);
+	if (ret) {
+		adin2111_write_reg(priv, ADIN2111_STATUS0,
+				   status0 & ADIN2111_STATUS0_RX_ERR);
+		adin2111_write_reg(priv, ADIN2111_FIFO_CLR, ADIN2111_FIFO_CLR_RX);
+		goto drop;
+	}
+
+	ret = adin2111_rx_decode_size(rx_fsize, ADIN2111_FRAME_HEADER_LEN,
+				      ADIN2111_MAX_FRAME_SIZE, &desc);
+	if (ret) {
+		dev_err(&priv->spi->dev, "Invalid frame size: %u\n", desc.fsize);
+		goto drop;
 	}
 
-	frame_buf = kmalloc(frame_size, GFP_KERNEL);
+	frame_buf = kmalloc(desc.fsize, GFP_KERNEL);
 	if (!frame_buf)
 		return;
 
 	/* Read frame data */
-	ret = adin2111_read_fifo(priv, ADIN2111_RX, frame_buf, frame_size);
+	ret = adin2111_read_fifo(priv, ADIN2111_RX, frame_buf, desc.fsize);
 	if (ret) {
 		dev_err(&priv->spi->dev, "Failed to read RX frame: %d\n", ret);
-		goto out;
+		goto drop;
 	}
 
-	/* Parse frame header */
-	frame_header = (frame_buf[0] << 8) | frame_buf[1];
-	port_mask = FIELD_GET(ADIN2111_FRAME_HEADER_PORT_MASK, frame_header);
+	ret = adin2111_rx_decode_hdr(frame_buf, &desc);
 
 	/* Determine target port */
 	if (priv->switch_mode) {
-		port_num = (port_mask & BIT(1)) ? 1 : 0;
-		if (port_num >= ADIN2111_PORTS || !priv->ports[port_num].netdev) {
-			dev_err(&priv->spi->dev, "Invalid port in frame header: %d\n", port_num);
-			goto out;
-		}
-		port = &priv->ports[port_num];
+		if (!ret && !priv->ports[desc.port].netdev)
+			ret = -EPROTO;
+		if (!ret)
+			port = &priv->ports[desc.port];
 		netdev = port->netdev;
 	} else {
 		netdev = priv->netdev;
 		port = netdev_priv(netdev);
 	}
 
+	if (ret)
+		goto drop;
+
 	/* Create SKB */
-	skb = netdev_alloc_skb(netdev, frame_size - ADIN2111_FRAME_HEADER_LEN + NET_IP_ALIGN);
+	skb = netdev_alloc_skb_ip_align(netdev, desc.len);
 	if (!skb) {
+		spin_lock(&port->stats_lock);
 		port->stats.rx_dropped++;
+		spin_unlock(&port->stats_lock);
 		goto out;
 	}
 
-	skb_reserve(skb, NET_IP_ALIGN);
-	skb_put_data(skb, frame_buf + ADIN2111_FRAME_HEADER_LEN,
-		     frame_size - ADIN2111_FRAME_HEADER_LEN);
+	skb_put_data(skb, frame_buf + desc.offset, desc.len);
 
 	skb->protocol = eth_type_trans(skb, netdev);
 	skb->ip_summed = CHECKSUM_NONE;
 
 	/* Update statistics */
+	spin_lock(&port->stats_lock);
 	port->stats.rx_packets++;
 	port->stats.rx_bytes += skb->len;
+	spin_unlock(&port->stats_lock);
 
 	/* Deliver to network stack */
 	netif_rx(skb);
+	goto out;
 
+drop:
+	spin_lock(&port->stats_lock);
+	adin2111_rx_count_drop(&port->stats, ret);
+	spin_unlock(&port->stats_lock);
 out:
 	kfree(frame_buf);
 }
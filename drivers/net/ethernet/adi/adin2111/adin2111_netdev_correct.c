@@ -110,10 +110,10 @@ static void adin2111_tx_worker(struct work_struct *work)
 		
 		if (!ret) {
 			/* Success - update stats */
-			u64_stats_update_begin(&port->stats_lock);
+			spin_lock_bh(&port->stats_lock);
 			port->stats.tx_packets++;
 			port->stats.tx_bytes += skb->len;
-			u64_stats_update_end(&port->stats_lock);
+			spin_unlock_bh(&port->stats_lock);
 			netdev_sent_queue(netdev, skb->len);
 		} else {
 			/* Error */
@@ -193,7 +193,8 @@ static int adin2111_rx_thread(void *data)
 	struct net_device *netdev = port->netdev;
 	
 	while (!kthread_should_stop()) {
-		u32 status1, rx_size;
+		struct adin2111_rx_desc desc;
+		u32 status0, status1, rx_size;
 		u32 rx_ready_mask;
 		int ret;
 		
@@ -228,19 +229,46 @@ static int adin2111_rx_thread(void *data)
 			continue;
 		}
 		
-		u16 frame_size = rx_size & 0xFFFF;
-		if (frame_size > ADIN2111_MAX_FRAME_SIZE) {
+		/* Flush the RX FIFO if the MAC flagged an RX error */
+		ret = adin2111_read_reg(priv, ADIN2111_STATUS0, &status0);
+		if (ret) {
+			mutex_unlock(&priv->lock);
+			continue;
+		}
+		
+		ret = adin2111_rx_decode_status(status0);
+		if (ret) {
+			adin2111_write_reg(priv, ADIN2111_STATUS0,
+					   status0 & ADIN2111_STATUS0_RX_ERR);
+			adin2111_write_reg(priv, ADIN2111_FIFO_CLR,
+					   ADIN2111_FIFO_CLR_RX);
+			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
+			mutex_unlock(&priv->lock);
+			continue;
+		}
+		
+		/* FIFO data is the bare frame, so only the size needs checking */
+		ret = adin2111_rx_decode_size(rx_size, 0, ADIN2111_MAX_FRAME_SIZE,
+					      &desc);
+		if (ret) {
 			/* Bad frame, clear it */
 			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
-			port->stats.rx_errors++;
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
 			mutex_unlock(&priv->lock);
 			continue;
 		}
 		
 		/* Allocate SKB */
-		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, frame_size);
+		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, desc.len);
 		if (!skb) {
+			spin_lock_bh(&port->stats_lock);
 			port->stats.rx_dropped++;
+			spin_unlock_bh(&port->stats_lock);
 			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
 			mutex_unlock(&priv->lock);
 			continue;
@@ -248,7 +276,7 @@ static int adin2111_rx_thread(void *data)
 		
 		/* Read frame from FIFO (can sleep) */
 		ret = adin2111_read_fifo(priv, ADIN2111_RX_FIFO, 
-					  skb->data, frame_size);
+					  skb->data, desc.len);
 		
 		/* Clear RX ready */
 		adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
@@ -256,18 +284,21 @@ static int adin2111_rx_thread(void *data)
 		
 		if (ret) {
 			dev_kfree_skb(skb);
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
 			continue;
 		}
 		
 		/* Setup SKB and deliver */
-		skb_put(skb, frame_size);
+		skb_put(skb, desc.len);
 		skb->protocol = eth_type_trans(skb, netdev);
 		
 		/* Update stats */
-		u64_stats_update_begin(&port->stats_lock);
+		spin_lock_bh(&port->stats_lock);
 		port->stats.rx_packets++;
-		port->stats.rx_bytes += frame_size;
-		u64_stats_update_end(&port->stats_lock);
+		port->stats.rx_bytes += desc.len;
+		spin_unlock_bh(&port->stats_lock);
 		
 		/* Deliver to network stack (we're in process context) */
 		netif_rx_ni(skb);
@@ -402,12 +433,10 @@ static void adin2111_get_stats64(struct net_device *netdev,
 				  struct rtnl_link_stats64 *stats)
 {
 	struct adin2111_port *port = netdev_priv(netdev);
-	unsigned int start;
 	
-	do {
-		start = u64_stats_fetch_begin(&port->stats_lock);
-		*stats = port->stats;
-	} while (u64_stats_fetch_retry(&port->stats_lock, start));
+	spin_lock_bh(&port->stats_lock);
+	*stats = port->stats;
+	spin_unlock_bh(&port->stats_lock);
 }
 
 /* Network device operations */
@@ -458,7 +487,7 @@ struct net_device *adin2111_create_netdev_correct(struct adin2111_priv *priv,
 	port->netdev = netdev;
 	port->priv = priv;
 	port->port_num = port_num;
-	u64_stats_init(&port->stats_lock);
+	spin_lock_init(&port->stats_lock);
 	
 	/* Initialize TX ring */
 	port_ext->tx_head = 0;
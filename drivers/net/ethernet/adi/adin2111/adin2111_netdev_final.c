@@ -195,7 +195,8 @@ static int adin2111_rx_thread(void *data)
 	struct net_device *netdev = port->netdev;
 	
 	while (!kthread_should_stop()) {
-		u32 status1, rx_size;
+		struct adin2111_rx_desc desc;
+		u32 status0, status1, rx_size;
 		u32 rx_ready_mask;
 		int ret;
 		
@@ -228,17 +229,44 @@ static int adin2111_rx_thread(void *data)
 			continue;
 		}
 		
-		u16 frame_size = rx_size & ADIN2111_RX_SIZE_MASK;
-		if (frame_size > ADIN2111_MAX_FRAME_SIZE) {
+		/* Flush the RX FIFO if the MAC flagged an RX error */
+		ret = adin2111_read_reg(priv, ADIN2111_STATUS0, &status0);
+		if (ret) {
+			mutex_unlock(&priv->lock);
+			continue;
+		}
+		
+		ret = adin2111_rx_decode_status(status0);
+		if (ret) {
+			adin2111_write_reg(priv, ADIN2111_STATUS0,
+					   status0 & ADIN2111_STATUS0_RX_ERR);
+			adin2111_write_reg(priv, ADIN2111_FIFO_CLR,
+					   ADIN2111_FIFO_CLR_RX);
+			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
+			mutex_unlock(&priv->lock);
+			continue;
+		}
+		
+		/* FIFO data is the bare frame, so only the size needs checking */
+		ret = adin2111_rx_decode_size(rx_size, 0, ADIN2111_MAX_FRAME_SIZE,
+					      &desc);
+		if (ret) {
 			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
-			netdev->stats.rx_errors++;
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
 			mutex_unlock(&priv->lock);
 			continue;
 		}
 		
-		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, frame_size);
+		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, desc.len);
 		if (!skb) {
-			netdev->stats.rx_dropped++;
+			u64_stats_update_begin(&port->stats_sync);
+			port->stats.rx_dropped++;
+			u64_stats_update_end(&port->stats_sync);
 			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
 			mutex_unlock(&priv->lock);
 			continue;
@@ -246,23 +274,26 @@ static int adin2111_rx_thread(void *data)
 		
 		/* Read frame from FIFO */
 		ret = adin2111_read_fifo(priv, ADIN2111_RX_FIFO, 
-					  skb->data, frame_size);
+					  skb->data, desc.len);
 		
 		adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
 		mutex_unlock(&priv->lock);
 		
 		if (ret) {
 			dev_kfree_skb(skb);
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
 			continue;
 		}
 		
-		skb_put(skb, frame_size);
+		skb_put(skb, desc.len);
 		skb->protocol = eth_type_trans(skb, netdev);
 		
 		/* Update stats with proper sync */
 		u64_stats_update_begin(&port->stats_sync);
 		port->stats.rx_packets++;
-		port->stats.rx_bytes += frame_size;
+		port->stats.rx_bytes += desc.len;
 		u64_stats_update_end(&port->stats_sync);
 		
 		/* Deliver to network stack */
@@ -198,7 +198,8 @@ static int adin2111_rx_thread(void *data)
 	struct net_device *netdev = port->netdev;
 	
 	while (!kthread_should_stop()) {
-		u32 rx_cnt, rx_size;
+		struct adin2111_rx_desc desc;
+		u32 rx_cnt, rx_size, status0 = 0;
 		int ret;
 		
 		if (!port->rx_thread_running) {
@@ -210,6 +211,8 @@ static int adin2111_rx_thread(void *data)
 		/* Check for RX frames */
 		mutex_lock(&priv->lock);
 		ret = adin2111_read_reg(priv, ADIN2111_RX_FSIZE, &rx_size);
+		if (!ret && rx_size)
+			ret = adin2111_read_reg(priv, ADIN2111_STATUS0, &status0);
 		mutex_unlock(&priv->lock);
 		
 		if (ret || rx_size == 0) {
@@ -217,26 +220,48 @@ static int adin2111_rx_thread(void *data)
 			continue;
 		}
 		
-		/* Read frame size */
-		u16 frame_size = rx_size & 0xFFFF;
-		if (frame_size > RX_MAX_FRAME_SIZE) {
-			dev_err(&priv->spi->dev, "Invalid RX size: %u\n", frame_size);
+		/* Flush the RX FIFO if the MAC flagged an RX error */
+		ret = adin2111_rx_decode_status(status0);
+		if (ret) {
+			mutex_lock(&priv->lock);
+			adin2111_write_reg(priv, ADIN2111_STATUS0,
+					   status0 & ADIN2111_STATUS0_RX_ERR);
+			adin2111_write_reg(priv, ADIN2111_FIFO_CLR,
+					   ADIN2111_FIFO_CLR_RX);
+			adin2111_write_reg(priv, ADIN2111_STATUS1, BIT(17));
+			mutex_unlock(&priv->lock);
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
+			continue;
+		}
+		
+		/* FIFO data is the bare frame, so only the size needs checking */
+		ret = adin2111_rx_decode_size(rx_size, 0, RX_MAX_FRAME_SIZE, &desc);
+		if (ret) {
+			dev_err_ratelimited(&priv->spi->dev, "Invalid RX size: %u\n",
+					    desc.fsize);
 			mutex_lock(&priv->lock);
 			adin2111_write_reg(priv, ADIN2111_STATUS1, BIT(17));
 			mutex_unlock(&priv->lock);
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
 			continue;
 		}
 		
 		/* Allocate SKB */
-		struct sk_buff *skb = netdev_alloc_skb(netdev, frame_size);
+		struct sk_buff *skb = netdev_alloc_skb(netdev, desc.len);
 		if (!skb) {
-			netdev->stats.rx_dropped++;
+			u64_stats_update_begin(&port->stats_sync);
+			port->stats.rx_dropped++;
+			u64_stats_update_end(&port->stats_sync);
 			continue;
 		}
 		
 		/* Read frame data */
 		mutex_lock(&priv->lock);
-		ret = adin2111_read_fifo(priv, ADIN2111_RX, skb->data, frame_size);
+		ret = adin2111_read_fifo(priv, ADIN2111_RX, skb->data, desc.len);
 		
 		/* Clear RX ready */
 		u32 rx_ready_mask = (port->port_num == 0) ? 
@@ -248,16 +273,19 @@ static int adin2111_rx_thread(void *data)
 		
 		if (ret) {
 			dev_kfree_skb(skb);
+			u64_stats_update_begin(&port->stats_sync);
+			adin2111_rx_count_drop(&port->stats, ret);
+			u64_stats_update_end(&port->stats_sync);
 			continue;
 		}
 		
-		skb_put(skb, frame_size);
+		skb_put(skb, desc.len);
 		skb->protocol = eth_type_trans(skb, netdev);
 		
 		/* Update stats with proper sync */
 		u64_stats_update_begin(&port->stats_sync);
 		port->stats.rx_packets++;
-		port->stats.rx_bytes += frame_size;
+		port->stats.rx_bytes += desc.len;
 		u64_stats_update_end(&port->stats_sync);
 		
 		/* Deliver to network stack - use kernel version appropriate function */
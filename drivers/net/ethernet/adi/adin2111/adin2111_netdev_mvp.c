@@ -30,8 +30,9 @@ static int adin2111_napi_poll(struct napi_struct *napi, int budget)
 	struct adin2111_port *port = container_of(napi, struct adin2111_port, napi);
 	struct adin2111_priv *priv = port->priv;
 	struct net_device *netdev = port->netdev;
+	struct adin2111_rx_desc desc;
 	int work_done = 0;
-	u32 status1, rx_size;
+	u32 status0, status1, rx_size;
 	int ret;
 
 	mutex_lock(&priv->lock);
@@ -54,39 +55,67 @@ static int adin2111_napi_poll(struct napi_struct *napi, int budget)
 		if (ret || rx_size == 0)
 			break;
 
-		/* Mask off port bits to get actual size */
-		u16 frame_size = rx_size & 0xFFFF;
-		if (frame_size > ADIN2111_MAX_FRAME_SIZE) {
-			dev_err(&priv->spi->dev, "Invalid frame size: %u\n", frame_size);
+		/* Flush the RX FIFO if the MAC flagged an RX error */
+		ret = adin2111_read_reg(priv, ADIN2111_STATUS0, &status0);
+		if (ret)
+			break;
+
+		ret = adin2111_rx_decode_status(status0);
+		if (ret) {
+			adin2111_write_reg(priv, ADIN2111_STATUS0,
+					   status0 & ADIN2111_STATUS0_RX_ERR);
+			adin2111_write_reg(priv, ADIN2111_FIFO_CLR,
+					   ADIN2111_FIFO_CLR_RX);
+			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
+			continue;
+		}
+
+		/* FIFO data is the bare frame, so only the size needs checking */
+		ret = adin2111_rx_decode_size(rx_size, 0, ADIN2111_MAX_FRAME_SIZE,
+					      &desc);
+		if (ret) {
+			if (net_ratelimit())
+				netdev_err(netdev, "Invalid frame size: %u\n",
+					   desc.fsize);
 			/* Clear bad frame */
 			adin2111_write_reg(priv, ADIN2111_STATUS1, rx_ready_mask);
-			port->stats.rx_errors++;
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
 			continue;
 		}
 
 		/* Allocate skb */
-		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, frame_size);
+		struct sk_buff *skb = netdev_alloc_skb_ip_align(netdev, desc.len);
 		if (!skb) {
+			spin_lock_bh(&port->stats_lock);
 			port->stats.rx_dropped++;
+			spin_unlock_bh(&port->stats_lock);
 			break;
 		}
 
 		/* Read frame from FIFO */
-		ret = adin2111_read_fifo(priv, ADIN2111_RX_FIFO, skb->data, frame_size);
+		ret = adin2111_read_fifo(priv, ADIN2111_RX_FIFO, skb->data, desc.len);
 		if (ret) {
 			dev_kfree_skb(skb);
+			spin_lock_bh(&port->stats_lock);
+			adin2111_rx_count_drop(&port->stats, ret);
+			spin_unlock_bh(&port->stats_lock);
 			break;
 		}
 
 		/* Setup skb */
-		skb_put(skb, frame_size);
+		skb_put(skb, desc.len);
 		skb->protocol = eth_type_trans(skb, netdev);
 
 		/* Update stats */
-		u64_stats_update_begin(&port->stats_lock);
+		spin_lock_bh(&port->stats_lock);
 		port->stats.rx_packets++;
-		port->stats.rx_bytes += frame_size;
-		u64_stats_update_end(&port->stats_lock);
+		port->stats.rx_bytes += desc.len;
+		spin_unlock_bh(&port->stats_lock);
 
 		/* Pass to network stack */
 		napi_gro_receive(napi, skb);
@@ -172,10 +201,10 @@ static netdev_tx_t adin2111_start_xmit(struct sk_buff *skb, struct net_device *n
 		port->stats.tx_errors++;
 	} else {
 		/* Update stats */
-		u64_stats_update_begin(&port->stats_lock);
+		spin_lock_bh(&port->stats_lock);
 		port->stats.tx_packets++;
 		port->stats.tx_bytes += skb->len;
-		u64_stats_update_end(&port->stats_lock);
+		spin_unlock_bh(&port->stats_lock);
 		
 		/* Notify stack */
 		netdev_sent_queue(netdev, skb->len);
@@ -256,12 +285,10 @@ static void adin2111_get_stats64(struct net_device *netdev,
 				  struct rtnl_link_stats64 *stats)
 {
 	struct adin2111_port *port = netdev_priv(netdev);
-	unsigned int start;
 
-	do {
-		start = u64_stats_fetch_begin(&port->stats_lock);
-		*stats = port->stats;
-	} while (u64_stats_fetch_retry(&port->stats_lock, start));
+	spin_lock_bh(&port->stats_lock);
+	*stats = port->stats;
+	spin_unlock_bh(&port->stats_lock);
 }
 
 /* Network device operations */
@@ -358,7 +385,7 @@ struct net_device *adin2111_create_netdev_mvp(struct adin2111_priv *priv, int po
 	port->netdev = netdev;
 	port->priv = priv;
 	port->port_num = port_num;
-	u64_stats_init(&port->stats_lock);
+	spin_lock_init(&port->stats_lock);
 
 	/* Add NAPI */
 	netif_napi_add(netdev, &port->napi, adin2111_napi_poll);
@@ -59,6 +59,8 @@
 #define ADIN2111_STATUS0_RXBOE		BIT(3)
 #define ADIN2111_STATUS0_RXEVM		BIT(4)
 #define ADIN2111_STATUS0_TXFCSE	BIT(5)
+#define ADIN2111_STATUS0_RX_ERR		(ADIN2111_STATUS0_RXBOE | \
+					 ADIN2111_STATUS0_RXEVM)
 
 #define ADIN2111_STATUS1		0x09
 #define ADIN2111_STATUS1_P2_RX_RDY	BIT(17)
@@ -98,6 +100,7 @@
 #define ADIN2111_TX_FSIZE		0x31
 #define ADIN2111_RX			0x90
 #define ADIN2111_RX_FSIZE		0x91
+#define ADIN2111_RX_FSIZE_MASK		GENMASK(10, 0)
 
 /* MDIO Access Control */
 #define ADIN2111_MDIO_ACC		0x20
@@ -20,17 +20,18 @@
 #include "qemu/module.h"
 #include "qemu/log.h"
 #include "qemu/timer.h"
+#include "qemu/host-utils.h"
 #include "hw/qdev-properties.h"
 #include "hw/net/adin2111.h"
 
 #define TYPE_ADIN2111 "adin2111"
 OBJECT_DECLARE_SIMPLE_TYPE(ADIN2111State, ADIN2111)
 
-/* Timing constants from datasheet (in microseconds) */
+/* Timing constants from datasheet */
 #define ADIN2111_RESET_TIME_MS      50    /* Reset to ready time */
-#define ADIN2111_PHY_RX_LATENCY_US  6400  /* 6.4µs PHY RX latency */
-#define ADIN2111_PHY_TX_LATENCY_US  3200  /* 3.2µs PHY TX latency */
-#define ADIN2111_SWITCH_LATENCY_US  12600 /* 12.6µs switch latency */
+#define ADIN2111_PHY_RX_LATENCY_NS  6400  /* 6.4µs PHY RX latency */
+#define ADIN2111_PHY_TX_LATENCY_NS  3200  /* 3.2µs PHY TX latency */
+#define ADIN2111_SWITCH_LATENCY_NS  12600 /* 12.6µs switch latency */
 #define ADIN2111_POWER_ON_TIME_MS   43    /* Power-on to ready */
 
 typedef struct ADIN2111State {
@@ -66,6 +67,13 @@ typedef struct ADIN2111State {
     uint64_t rx_errors[2];
     uint64_t tx_errors[2];
     
+    /* IEEE 1588 clock, running off QEMU_CLOCK_VIRTUAL */
+    int64_t ptp_base_ns;        /* PTP time at ptp_virt_base_ns */
+    int64_t ptp_virt_base_ns;   /* Virtual time of last clock anchor */
+    int32_t ptp_freq_ppb;       /* Frequency adjustment */
+    uint32_t ptp_set_sec;       /* Pending seconds for PTP_CLK_NS write */
+    uint32_t ptp_snap_ns;       /* Nanoseconds latched by PTP_CLK_SEC read */
+    
     /* Timers for realistic timing */
     QEMUTimer *reset_timer;
     QEMUTimer *switch_timer;
@@ -86,6 +94,47 @@ enum {
     SPI_STATE_DATA,
 };
 
+/* Current PTP clock time in ns, scaled from the virtual clock */
+static int64_t adin2111_ptp_now(ADIN2111State *s)
+{
+    uint64_t elapsed = qemu_clock_get_ns(QEMU_CLOCK_VIRTUAL) -
+                       s->ptp_virt_base_ns;
+    int64_t adj = muldiv64(elapsed, ABS(s->ptp_freq_ppb),
+                           NANOSECONDS_PER_SECOND);
+    
+    return s->ptp_base_ns + elapsed + (s->ptp_freq_ppb < 0 ? -adj : adj);
+}
+
+/* Re-anchor the PTP clock so it reads @ns at the current virtual time */
+static void adin2111_ptp_set(ADIN2111State *s, int64_t ns)
+{
+    s->ptp_virt_base_ns = qemu_clock_get_ns(QEMU_CLOCK_VIRTUAL);
+    s->ptp_base_ns = MAX(ns, 0);
+}
+
+/*
+ * Latch a frame timestamp into its register pair and raise capture IRQ.
+ * An unread capture is never overwritten; the lost one sets @ovr instead.
+ */
+static void adin2111_ptp_capture(ADIN2111State *s, int64_t ns,
+                                 uint32_t sec_reg, uint32_t valid,
+                                 uint32_t ovr, uint32_t int_bit)
+{
+    if (s->regs[ADIN2111_REG_TIMESTAMP_CTRL] & valid) {
+        s->regs[ADIN2111_REG_TIMESTAMP_CTRL] |= ovr;
+        return;
+    }
+    
+    s->regs[sec_reg] = ns / NANOSECONDS_PER_SECOND;
+    s->regs[sec_reg + 1] = ns % NANOSECONDS_PER_SECOND;
+    s->regs[ADIN2111_REG_TIMESTAMP_CTRL] |= valid;
+    
+    s->int_status |= int_bit;
+    if (s->int_status & s->int_mask) {
+        qemu_irq_raise(s->irq);
+    }
+}
+
 /* Register read implementation */
 static uint32_t adin2111_reg_read(ADIN2111State *s, uint32_t addr)
 {
@@ -127,6 +176,38 @@ static uint32_t adin2111_reg_read(ADIN2111State *s, uint32_t addr)
         val = (s->nic[1] && !qemu_get_queue(s->nic[1])->link_down) ? 0x01 : 0x00;
         break;
         
+    case ADIN2111_REG_TX_TIMESTAMP_NS:
+        /* Reading the nanoseconds word releases the capture */
+        val = s->regs[addr];
+        s->regs[ADIN2111_REG_TIMESTAMP_CTRL] &= ~ADIN2111_TS_CTRL_TX_VALID;
+        break;
+        
+    case ADIN2111_REG_RX_TIMESTAMP_NS:
+        val = s->regs[addr];
+        s->regs[ADIN2111_REG_TIMESTAMP_CTRL] &= ~ADIN2111_TS_CTRL_RX_VALID;
+        break;
+        
+    case ADIN2111_REG_PTP_CLK_SEC: {
+        /* Seconds read latches nanoseconds for a coherent pair */
+        int64_t now = adin2111_ptp_now(s);
+        
+        val = now / NANOSECONDS_PER_SECOND;
+        s->ptp_snap_ns = now % NANOSECONDS_PER_SECOND;
+        break;
+    }
+        
+    case ADIN2111_REG_PTP_CLK_NS:
+        val = s->ptp_snap_ns;
+        break;
+        
+    case ADIN2111_REG_PTP_ADJ_FREQ:
+        val = s->ptp_freq_ppb;
+        break;
+        
+    case ADIN2111_REG_PTP_ADJ_OFFSET:
+        val = 0;  /* Write-only */
+        break;
+        
     default:
         if (addr < ADIN2111_REG_COUNT) {
             val = s->regs[addr];
@@ -170,6 +251,47 @@ static void adin2111_reg_write(ADIN2111State *s, uint32_t addr, uint32_t val)
         s->switch_enabled = (val & 0x10) ? true : false;
         break;
         
+    case ADIN2111_REG_TIMESTAMP_CTRL:
+        /* Valid bits are read-only, overrun bits write 1 to clear */
+        s->regs[addr] = (val & (ADIN2111_TS_CTRL_RX_EN |
+                                ADIN2111_TS_CTRL_TX_EN)) |
+                        (s->regs[addr] & (ADIN2111_TS_CTRL_RX_VALID |
+                                          ADIN2111_TS_CTRL_TX_VALID)) |
+                        (s->regs[addr] & ~val & (ADIN2111_TS_CTRL_RX_OVR |
+                                                 ADIN2111_TS_CTRL_TX_OVR));
+        break;
+        
+    case ADIN2111_REG_TX_TIMESTAMP_SEC:
+    case ADIN2111_REG_TX_TIMESTAMP_NS:
+    case ADIN2111_REG_RX_TIMESTAMP_SEC:
+    case ADIN2111_REG_RX_TIMESTAMP_NS:
+        break;  /* Read-only capture registers */
+        
+    case ADIN2111_REG_PTP_CLK_SEC:
+        s->ptp_set_sec = val;  /* Applied by the nanoseconds write */
+        break;
+        
+    case ADIN2111_REG_PTP_CLK_NS:
+        if (val >= NANOSECONDS_PER_SECOND) {
+            qemu_log_mask(LOG_GUEST_ERROR,
+                         "adin2111: invalid PTP nanoseconds %u\n", val);
+            break;
+        }
+        adin2111_ptp_set(s, (int64_t)s->ptp_set_sec * NANOSECONDS_PER_SECOND +
+                            val);
+        break;
+        
+    case ADIN2111_REG_PTP_ADJ_FREQ:
+        /* Re-anchor so the new rate only applies from now on */
+        adin2111_ptp_set(s, adin2111_ptp_now(s));
+        s->ptp_freq_ppb = MIN(MAX((int32_t)val, -ADIN2111_PTP_MAX_ADJ_PPB),
+                              ADIN2111_PTP_MAX_ADJ_PPB);
+        break;
+        
+    case ADIN2111_REG_PTP_ADJ_OFFSET:
+        adin2111_ptp_set(s, adin2111_ptp_now(s) + (int32_t)val);
+        break;
+        
     default:
         if (addr < ADIN2111_REG_COUNT) {
             s->regs[addr] = val;
@@ -235,6 +357,8 @@ static ssize_t adin2111_receive(NetClientState *nc, const uint8_t *buf, size_t s
     ADIN2111State *s = qemu_get_nic_opaque(nc);
     int port = (nc == qemu_get_queue(s->nic[0])) ? 0 : 1;
     int other_port = 1 - port;
+    uint32_t ts_ctrl = s->regs[ADIN2111_REG_TIMESTAMP_CTRL];
+    int64_t rx_ts;
     
     /* Update statistics */
     s->rx_packets[port]++;
@@ -245,18 +369,35 @@ static ssize_t adin2111_receive(NetClientState *nc, const uint8_t *buf, size_t s
         return size;  /* Drop packet */
     }
     
+    /* Ingress timestamp at the MAC interface */
+    rx_ts = adin2111_ptp_now(s);
+    if (ts_ctrl & ADIN2111_TS_CTRL_RX_EN) {
+        adin2111_ptp_capture(s, rx_ts, ADIN2111_REG_RX_TIMESTAMP_SEC,
+                             ADIN2111_TS_CTRL_RX_VALID,
+                             ADIN2111_TS_CTRL_RX_OVR, ADIN2111_INT_RX_TS);
+    }
+    
     /* If switch is enabled, forward to other port */
     if (s->switch_enabled && s->nic[other_port]) {
         /* Emulate switching latency */
-        int64_t latency_ns = (ADIN2111_PHY_RX_LATENCY_US + 
-                             ADIN2111_SWITCH_LATENCY_US +
-                             ADIN2111_PHY_TX_LATENCY_US) * 1000;
+        int64_t latency_ns = ADIN2111_PHY_RX_LATENCY_NS +
+                             ADIN2111_SWITCH_LATENCY_NS +
+                             ADIN2111_PHY_TX_LATENCY_NS;
         
         if (s->cut_through_mode) {
             /* Cut-through: minimal latency */
             latency_ns /= 2;
         }
         
+        /* Egress timestamp reflects the emulated port-to-port latency */
+        if (ts_ctrl & ADIN2111_TS_CTRL_TX_EN) {
+            adin2111_ptp_capture(s, rx_ts + latency_ns,
+                                 ADIN2111_REG_TX_TIMESTAMP_SEC,
+                                 ADIN2111_TS_CTRL_TX_VALID,
+                                 ADIN2111_TS_CTRL_TX_OVR,
+                                 ADIN2111_INT_TX_TS);
+        }
+        
         /* Forward packet to other port after latency */
         /* Note: In real implementation, would use timer for delayed send */
         qemu_send_packet(qemu_get_queue(s->nic[other_port]), buf, size);
@@ -325,6 +466,12 @@ static void adin2111_reset(DeviceState *dev)
     s->int_status = 0;
     s->int_mask = 0;
     
+    /* Restart PTP clock from zero with no adjustment */
+    adin2111_ptp_set(s, 0);
+    s->ptp_freq_ppb = 0;
+    s->ptp_set_sec = 0;
+    s->ptp_snap_ns = 0;
+    
     /* Clear statistics */
     memset(s->rx_packets, 0, sizeof(s->rx_packets));
     memset(s->tx_packets, 0, sizeof(s->tx_packets));
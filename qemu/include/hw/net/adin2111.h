@@ -65,6 +65,10 @@
 #define ADIN2111_REG_TX_TIMESTAMP_NS 0x0102  /* TX timestamp nanoseconds */
 #define ADIN2111_REG_RX_TIMESTAMP_SEC 0x0103 /* RX timestamp seconds */
 #define ADIN2111_REG_RX_TIMESTAMP_NS 0x0104  /* RX timestamp nanoseconds */
+#define ADIN2111_REG_PTP_CLK_SEC    0x0105  /* PTP clock seconds */
+#define ADIN2111_REG_PTP_CLK_NS     0x0106  /* PTP clock nanoseconds */
+#define ADIN2111_REG_PTP_ADJ_FREQ   0x0107  /* PTP frequency adjust (s32 ppb) */
+#define ADIN2111_REG_PTP_ADJ_OFFSET 0x0108  /* PTP offset step (s32 ns, WO) */
 
 /* TX/RX Buffers (0x0200 - 0x03FF) */
 #define ADIN2111_REG_TX_FIFO        0x0200  /* TX FIFO base */
@@ -96,6 +100,8 @@
 #define ADIN2111_INT_TX1_DONE       0x00000020  /* Port 1 TX complete */
 #define ADIN2111_INT_TX2_DONE       0x00000040  /* Port 2 TX complete */
 #define ADIN2111_INT_SPI_ERROR      0x00000080  /* SPI error */
+#define ADIN2111_INT_RX_TS          0x00000100  /* RX timestamp captured */
+#define ADIN2111_INT_TX_TS          0x00000200  /* TX timestamp captured */
 
 /* Switch Configuration Bits */
 #define ADIN2111_SWITCH_CUT_THROUGH 0x00000001  /* Cut-through mode */
@@ -107,10 +113,19 @@
 #define ADIN2111_PORT_LOOPBACK      0x00000002  /* Loopback mode */
 #define ADIN2111_PORT_TEST_MODE     0x00000004  /* Test mode */
 
+/* Timestamp Control Bits */
+#define ADIN2111_TS_CTRL_RX_EN      0x00000001  /* Capture ingress timestamps */
+#define ADIN2111_TS_CTRL_TX_EN      0x00000002  /* Capture egress timestamps */
+#define ADIN2111_TS_CTRL_RX_VALID   0x00000100  /* RX timestamp valid (RO) */
+#define ADIN2111_TS_CTRL_TX_VALID   0x00000200  /* TX timestamp valid (RO) */
+#define ADIN2111_TS_CTRL_RX_OVR     0x00000400  /* RX capture lost (W1C) */
+#define ADIN2111_TS_CTRL_TX_OVR     0x00000800  /* TX capture lost (W1C) */
+
 /* Constants */
 #define ADIN2111_MAC_TABLE_SIZE     16          /* 16 MAC filter entries */
 #define ADIN2111_MAC_ENTRY_SIZE     8           /* 6 bytes MAC + 2 bytes ctrl */
 #define ADIN2111_FIFO_SIZE          0x7000      /* 28KB shared buffer */
 #define ADIN2111_MAX_FRAME_SIZE     1518        /* Maximum Ethernet frame */
+#define ADIN2111_PTP_MAX_ADJ_PPB    1000000     /* +/-1000 ppm frequency adjust */
 
 #endif /* HW_NET_ADIN2111_H */
\ No newline at end of file
@@ -10,6 +10,7 @@
 #include "qemu/osdep.h"
 #include "libqtest.h"
 #include "qapi/qmp/qdict.h"
+#include "qemu/bswap.h"
 #include "hw/net/adin2111.h"
 
 /* Test fixture */
@@ -254,6 +255,156 @@ static void test_timing_emulation(void)
     qtest_quit(s.qts);
 }
 
+static uint64_t adin2111_read_ptp_ns(ADIN2111TestState *s)
+{
+    /* Seconds read latches nanoseconds */
+    uint64_t sec = adin2111_read_reg(s, ADIN2111_REG_PTP_CLK_SEC);
+    
+    return sec * 1000000000ULL + adin2111_read_reg(s, ADIN2111_REG_PTP_CLK_NS);
+}
+
+static void test_ptp_clock(void)
+{
+    ADIN2111TestState s = {0};
+    uint64_t t0, t1;
+    
+    s.qts = qtest_init("-device adin2111");
+    
+    /* Set clock and verify it advances with virtual time */
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_CLK_SEC, 100);
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_CLK_NS, 0);
+    t0 = adin2111_read_ptp_ns(&s);
+    g_assert_cmpuint(t0 / 1000000000ULL, ==, 100);
+    
+    qtest_clock_step(s.qts, 1000000000);  /* 1s */
+    t1 = adin2111_read_ptp_ns(&s);
+    g_assert_cmpuint(t1 - t0, >=, 1000000000);
+    g_assert_cmpuint(t1 - t0, <, 1000100000);
+    
+    /* +100ppm runs 100us fast per second */
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_ADJ_FREQ, 100000);
+    t0 = adin2111_read_ptp_ns(&s);
+    qtest_clock_step(s.qts, 1000000000);
+    t1 = adin2111_read_ptp_ns(&s);
+    g_assert_cmpuint(t1 - t0, >=, 1000100000);
+    g_assert_cmpuint(t1 - t0, <, 1000200000);
+    
+    /* Offset step moves the clock backwards */
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_ADJ_FREQ, 0);
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_ADJ_OFFSET, (uint32_t)-500000000);
+    t0 = adin2111_read_ptp_ns(&s);
+    g_assert_cmpuint(t0, <, t1);
+    
+    /* Capture registers are read-only and start invalid */
+    adin2111_write_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL,
+                      ADIN2111_TS_CTRL_RX_EN | ADIN2111_TS_CTRL_TX_EN |
+                      ADIN2111_TS_CTRL_RX_VALID);
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL), ==,
+                     ADIN2111_TS_CTRL_RX_EN | ADIN2111_TS_CTRL_TX_EN);
+    adin2111_write_reg(&s, ADIN2111_REG_RX_TIMESTAMP_SEC, 0x1234);
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_RX_TIMESTAMP_SEC), ==, 0);
+    
+    qtest_quit(s.qts);
+}
+
+/* Send one frame over a stream -netdev socket (length-prefixed) */
+static void adin2111_inject_frame(int fd)
+{
+    uint8_t frame[64] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff,     /* Broadcast */
+        0x52, 0x54, 0x00, 0x12, 0x34, 0x56,     /* Source */
+        0x88, 0xf7,                             /* PTP EtherType */
+    };
+    uint32_t len = cpu_to_be32(sizeof(frame));
+    
+    g_assert_cmpint(write(fd, &len, sizeof(len)), ==, sizeof(len));
+    g_assert_cmpint(write(fd, frame, sizeof(frame)), ==, sizeof(frame));
+}
+
+/* Poll a register until all @bits are set; register reads run the main loop */
+static uint32_t adin2111_wait_bits(ADIN2111TestState *s, uint16_t addr,
+                                   uint32_t bits)
+{
+    gint64 deadline = g_get_monotonic_time() + 5 * G_USEC_PER_SEC;
+    uint32_t val;
+    
+    do {
+        val = adin2111_read_reg(s, addr);
+        if ((val & bits) == bits) {
+            return val;
+        }
+        g_usleep(1000);
+    } while (g_get_monotonic_time() < deadline);
+    
+    g_assert_not_reached();
+}
+
+static void test_ptp_capture(void)
+{
+    ADIN2111TestState s = {0};
+    uint32_t ctrl, status;
+    int sv[2];
+    
+    g_assert_cmpint(socketpair(PF_UNIX, SOCK_STREAM, 0, sv), ==, 0);
+    s.qts = qtest_initf("-netdev socket,fd=%d,id=n1 "
+                        "-device adin2111,netdev=n1", sv[1]);
+    
+    /* Virtual time is frozen under qtest, so captures are exact */
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_CLK_SEC, 100);
+    adin2111_write_reg(&s, ADIN2111_REG_PTP_CLK_NS, 0);
+    adin2111_write_reg(&s, ADIN2111_REG_INT_MASK,
+                      ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS);
+    adin2111_write_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL,
+                      ADIN2111_TS_CTRL_RX_EN | ADIN2111_TS_CTRL_TX_EN);
+    
+    adin2111_inject_frame(sv[0]);
+    status = adin2111_wait_bits(&s, ADIN2111_REG_INT_STATUS,
+                                ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS);
+    g_assert_cmpuint(status & (ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS), ==,
+                     ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS);
+    
+    ctrl = adin2111_read_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL);
+    g_assert_cmpuint(ctrl & (ADIN2111_TS_CTRL_RX_VALID |
+                             ADIN2111_TS_CTRL_TX_VALID), ==,
+                     ADIN2111_TS_CTRL_RX_VALID | ADIN2111_TS_CTRL_TX_VALID);
+    
+    /* A second frame must not overwrite the unread captures */
+    qtest_clock_step(s.qts, 1000000);  /* 1ms */
+    adin2111_inject_frame(sv[0]);
+    adin2111_wait_bits(&s, ADIN2111_REG_TIMESTAMP_CTRL,
+                       ADIN2111_TS_CTRL_RX_OVR | ADIN2111_TS_CTRL_TX_OVR);
+    
+    /* Ingress at the set time; egress adds 11.1us cut-through latency */
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_RX_TIMESTAMP_SEC), ==, 100);
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_RX_TIMESTAMP_NS), ==, 0);
+    ctrl = adin2111_read_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL);
+    g_assert_cmpuint(ctrl & ADIN2111_TS_CTRL_RX_VALID, ==, 0);
+    g_assert_cmpuint(ctrl & ADIN2111_TS_CTRL_TX_VALID, ==,
+                     ADIN2111_TS_CTRL_TX_VALID);
+    
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_TX_TIMESTAMP_SEC), ==, 100);
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_TX_TIMESTAMP_NS), ==, 11100);
+    ctrl = adin2111_read_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL);
+    g_assert_cmpuint(ctrl & ADIN2111_TS_CTRL_TX_VALID, ==, 0);
+    
+    /* Overrun bits are write 1 to clear */
+    adin2111_write_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL,
+                      ADIN2111_TS_CTRL_RX_EN | ADIN2111_TS_CTRL_TX_EN |
+                      ADIN2111_TS_CTRL_RX_OVR | ADIN2111_TS_CTRL_TX_OVR);
+    g_assert_cmpuint(adin2111_read_reg(&s, ADIN2111_REG_TIMESTAMP_CTRL), ==,
+                     ADIN2111_TS_CTRL_RX_EN | ADIN2111_TS_CTRL_TX_EN);
+    
+    /* Capture interrupts are write 1 to clear */
+    adin2111_write_reg(&s, ADIN2111_REG_INT_STATUS,
+                      ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS);
+    status = adin2111_read_reg(&s, ADIN2111_REG_INT_STATUS);
+    g_assert_cmpuint(status & (ADIN2111_INT_RX_TS | ADIN2111_INT_TX_TS), ==, 0);
+    
+    qtest_quit(s.qts);
+    close(sv[0]);
+    close(sv[1]);
+}
+
 /* Main test registration */
 int main(int argc, char **argv)
 {
@@ -267,6 +418,8 @@ int main(int argc, char **argv)
     qtest_add_func("/adin2111/mac_table", test_mac_table);
     qtest_add_func("/adin2111/statistics", test_port_statistics);
     qtest_add_func("/adin2111/timing", test_timing_emulation);
+    qtest_add_func("/adin2111/ptp_clock", test_ptp_clock);
+    qtest_add_func("/adin2111/ptp_capture", test_ptp_capture);
     
     return g_test_run();
 }
\ No newline at end of file